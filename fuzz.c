@@ -0,0 +1,1389 @@
+// @BAKE gcc -o $*.out $@ -std=c23 -Wall -Wpedantic -O2 -ggdb && gcc -o $*.scalar.out $@ -std=c23 -Wall -Wpedantic -O2 -ggdb -DSTRLIST_NO_SIMD && ./fuzz.out && ./fuzz.scalar.out
+/* Differential fuzzing and throughput harness.
+ *
+ * The library is free to accelerate its kernels however it likes;
+ *  the scalar implementation below is the frozen reference they must agree with.
+ *  Do not "fix" or speed up the reference,
+ *  change it only when the intended behaviour of the library changes.
+ *
+ * Usage:
+ *   ./fuzz.out [-s seed] [-i iterations]   differential fuzzing
+ *   ./fuzz.out -b [-B baseline]            throughput per kernel (-B implies -b);
+ *                                          fails if a speedup regressed against the baseline
+ *                                          (a previous -b output, e.g. bench_output.txt),
+ *                                          or if the baseline is unreadable or lacks a kernel
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include "strlist.h"
+
+// --- Reference (scalar, as of the introduction of this harness)
+// Char variants
+size_t ref_strlist_len_char(cstrlist list, char sep) {
+    assert(list);
+
+    const char * s = list;
+
+    if (s[0] == '\0') { return 0; }
+
+    if (s[0] == sep) { ++s; }
+
+    size_t r = 1;
+    while ((s = strchr(s, sep))) {
+        ++s;
+        ++r;
+    }
+    return r;
+}
+
+size_t ref_strlist_element_position_char(cstrlist list, size_t n, char sep) {
+    assert(list);
+
+    const char * s = list;
+
+    if (n == 0) { return 0; }
+
+    size_t i = 0;
+
+    const char * start = s;
+    while (true) {
+        start = strchr(start, sep);
+        if (!start) {
+            return SIZE_MAX;
+        }
+        ++start;
+        ++i;
+        if (i == n) {
+            break;
+        }
+    }
+
+    return start - s;
+}
+
+char * ref_strlist_element_char(strlist list, size_t n, char sep) {
+    assert(list);
+
+    // Find start
+    const size_t start_pos = ref_strlist_element_position_char(list, n, sep);
+    if (start_pos == SIZE_MAX) { goto out_of_range; }
+    const char * start = list + start_pos;
+
+    // Find end
+    const char * end = strchr(start, sep);
+    if (!end) {
+        end = start + strlen(start);
+    }
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+strlist ref_strlist_elements_char(strlist list, size_t from, size_t n, char sep) {
+    assert(list);
+
+    // Find start
+    char * start;
+    if (from == 0) {
+        start = list;
+    } else {
+        const bool correction = (list[0] == sep);
+        const size_t start_pos = ref_strlist_element_position_char(
+            list + correction,
+            from,
+            sep
+        );
+        if (start_pos == SIZE_MAX) { goto out_of_range; }
+        start = list + start_pos + correction;
+    }
+
+    // Find end
+    char * end;
+    do {
+        char * search_end_from = (from == 0 && list[0] == sep ? start + 1 : start);
+        const size_t end_element_start_pos = ref_strlist_element_position_char(
+            search_end_from,
+            n ? n-1 : n,
+            sep
+        );
+        if (end_element_start_pos == SIZE_MAX) {
+            const size_t end_pos = strlen(start);
+            memmove(list, start, end_pos);
+            list[end_pos] = '\0';
+            return list;
+        }
+        end = search_end_from + end_element_start_pos;
+        while (*end != sep
+        &&     *end != '\0') {
+            ++end;
+        }
+    } while (0);
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+// String variants
+size_t ref_strlist_len_str(cstrlist list, const char * sep) {
+    assert(list);
+    assert(sep);
+
+    const char * s = list;
+
+    if (s[0] == '\0') { return 0; }
+
+    if (!strncmp(s, sep, strlen(sep))) { s += strlen(sep); }
+
+    size_t r = 1;
+    while ((s = strstr(s, sep))) {
+        s += strlen(sep);
+        ++r;
+    }
+    return r;
+}
+
+size_t ref_strlist_element_position_str(cstrlist list, size_t n, const char * sep) {
+    assert(list);
+    assert(sep);
+
+    const char * s = list;
+
+    if (n == 0) { return 0; }
+
+    size_t i = 0;
+
+    const char * start = s;
+    while (true) {
+        start = strstr(start, sep);
+        if (!start) {
+            return SIZE_MAX;
+        }
+        start += strlen(sep);
+        ++i;
+        if (i == n) {
+            break;
+        }
+    }
+
+    return start - s;
+}
+
+char * ref_strlist_element_str(strlist list, size_t n, const char * sep) {
+    assert(list);
+    assert(sep);
+
+    // Find start
+    const size_t start_pos = ref_strlist_element_position_str(list, n, sep);
+    if (start_pos == SIZE_MAX) { goto out_of_range; }
+    const char * start = list + start_pos;
+
+    // Find end
+    const char * end = strstr(start, sep);
+    if (!end) {
+        end = start + strlen(start);
+    }
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+strlist ref_strlist_elements_str(strlist list, size_t from, size_t n, const char * sep) {
+    assert(list);
+    assert(sep);
+
+    const bool has_leading_separator = !strncmp(list, sep, strlen(sep));
+
+    // Find start
+    char * start;
+    if (from == 0) {
+        start = list;
+    } else {
+        const int correction = (has_leading_separator ? strlen(sep) : 0);
+        const size_t start_pos = ref_strlist_element_position_str(
+            list + correction,
+            from,
+            sep
+        );
+        if (start_pos == SIZE_MAX) { goto out_of_range; }
+        start = list + start_pos + correction;
+    }
+
+    // Find end
+    char * end;
+    do {
+        char * search_end_from = (from == 0 && has_leading_separator
+            ? start + strlen(sep)
+            : start
+        );
+        const size_t end_element_start_pos = ref_strlist_element_position_str(
+            search_end_from,
+            n ? n-1 : n,
+            sep
+        );
+        if (end_element_start_pos == SIZE_MAX) {
+            const size_t end_pos = strlen(start);
+            memmove(list, start, end_pos);
+            list[end_pos] = '\0';
+            return list;
+        }
+        end = search_end_from + end_element_start_pos;
+        end = strstr(end, sep);
+        if (!end) {
+            end = search_end_from + end_element_start_pos
+                + strlen(search_end_from + end_element_start_pos);
+        }
+    } while (0);
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+// String array
+
+int ref_strlist_strstrlcmp_(const char * s, sep_t sep, const char * * match) {
+    for (auto w = sep; *w != NULL; w++) {
+        if (!strncmp(s, *w, strlen(*w))) {
+            *match = *w;
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+char * ref_strlist_strstrl_(const char * s, sep_t sep, const char * * match) {
+    char * r = NULL;
+    for (auto w = sep; *w != NULL; w++) {
+        char * i = strstr(s, *w);
+        if (i
+        && (r == NULL || r > i)) {
+            *match = *w;
+            r = i;
+        }
+    }
+
+    return r;
+}
+
+size_t ref_strlist_len_strl(cstrlist list, sep_t sep) {
+    assert(list);
+    assert(sep);
+
+    const char * s = list;
+
+    if (s[0] == '\0') { return 0; }
+
+    do {
+        const char * first_sep;
+        if (!ref_strlist_strstrlcmp_(s, sep, &first_sep)) {
+            s += strlen(first_sep);
+        }
+    } while (0);
+
+    size_t r = 1;
+    const char * separator;
+    while ((s = ref_strlist_strstrl_(s, sep, &separator))) {
+        s += strlen(separator);
+        ++r;
+    }
+    return r;
+}
+
+size_t ref_strlist_element_position_strl(cstrlist list, size_t n, sep_t sep) {
+    assert(list);
+    assert(sep);
+
+    const char * s = list;
+
+    if (n == 0) { return 0; }
+
+    size_t i = 0;
+
+    const char * start = s;
+    while (true) {
+        const char * separator;
+        start = ref_strlist_strstrl_(start, sep, &separator);
+        if (!start) {
+            return SIZE_MAX;
+        }
+        start += strlen(separator);
+        ++i;
+        if (i == n) {
+            break;
+        }
+    }
+
+    return start - s;
+}
+
+char * ref_strlist_element_strl(strlist list, size_t n, sep_t sep) {
+    assert(list);
+    assert(sep);
+
+    // Find start
+    const size_t start_pos = ref_strlist_element_position_strl(list, n, sep);
+    if (start_pos == SIZE_MAX) { goto out_of_range; }
+    const char * start = list + start_pos;
+
+    // Find end
+    [[ maybe_unused ]] const char * dummy;
+    const char * end = ref_strlist_strstrl_(start, sep, &dummy);
+    if (!end) {
+        end = start + strlen(start);
+    }
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+strlist ref_strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep) {
+    assert(list);
+    assert(sep);
+
+    const char * leading_separator;
+    const bool has_leading_separator = !ref_strlist_strstrlcmp_(list, sep, &leading_separator);
+
+    // Find start
+    char * start;
+    if (from == 0) {
+        start = list;
+    } else {
+        const int correction = (has_leading_separator ? strlen(leading_separator) : 0);
+        const size_t start_pos = ref_strlist_element_position_strl(
+            list + correction,
+            from,
+            sep
+        );
+        if (start_pos == SIZE_MAX) { goto out_of_range; }
+        start = list + start_pos + correction;
+    }
+
+    // Find end
+    char * end;
+    do {
+        char * search_end_from = (from == 0 && has_leading_separator
+            ? start + strlen(leading_separator)
+            : start
+        );
+        const size_t end_element_start_pos = ref_strlist_element_position_strl(
+            search_end_from,
+            n ? n-1 : n,
+            sep
+        );
+        if (end_element_start_pos == SIZE_MAX) {
+            const size_t end_pos = strlen(start);
+            memmove(list, start, end_pos);
+            list[end_pos] = '\0';
+            return list;
+        }
+        end = search_end_from + end_element_start_pos;
+        [[ maybe_unused ]] const char * dummy;
+        end = ref_strlist_strstrl_(end, sep, &dummy);
+        if (!end) {
+            end = search_end_from + end_element_start_pos
+                + strlen(search_end_from + end_element_start_pos);
+        }
+    } while (0);
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+
+// Matching modes
+/* Unlike the above, this is not a copy of the library,
+ *  but the plainest possible reading of the spec.
+ */
+const char * ref_strlist_match_mode_(const char * s, sep_mode_t sep) {
+    for (auto w = sep.sep; *w != NULL; w++) {
+        const size_t len = strlen(*w);
+        if (sep.mode & STRLIST_ICASE) {
+            if (strncasecmp(s, *w, len)) { continue; }
+        } else {
+            if (strncmp(s, *w, len)) { continue; }
+        }
+        if ((sep.mode & STRLIST_UTF8)
+        &&  (((unsigned char)s[0] & 0xC0) == 0x80 || ((unsigned char)s[len] & 0xC0) == 0x80)) {
+            continue;
+        }
+        return *w;
+    }
+
+    return NULL;
+}
+
+char * ref_strlist_strstrl_mode_(const char * s, sep_mode_t sep, const char * * match) {
+    for (const char * p = s; *p != '\0'; p++) {
+        const char * w = ref_strlist_match_mode_(p, sep);
+        if (w) {
+            *match = w;
+            return (char *)p;
+        }
+    }
+
+    return NULL;
+}
+
+int ref_strlist_strstrlcmp_mode_(const char * s, sep_mode_t sep, const char * * match) {
+    const char * w = ref_strlist_match_mode_(s, sep);
+    if (!w) { return 1; }
+
+    *match = w;
+    return 0;
+}
+
+/* The interface on top of the spec kernels, in the shape of the char** reference.
+ */
+size_t ref_strlist_len_mode(cstrlist list, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * s = list;
+
+    if (s[0] == '\0') { return 0; }
+
+    do {
+        const char * first_sep;
+        if (!ref_strlist_strstrlcmp_mode_(s, sep, &first_sep)) {
+            s += strlen(first_sep);
+        }
+    } while (0);
+
+    size_t r = 1;
+    const char * separator;
+    while ((s = ref_strlist_strstrl_mode_(s, sep, &separator))) {
+        s += strlen(separator);
+        ++r;
+    }
+    return r;
+}
+
+size_t ref_strlist_element_position_mode(cstrlist list, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * s = list;
+
+    if (n == 0) { return 0; }
+
+    size_t i = 0;
+
+    const char * start = s;
+    while (true) {
+        const char * separator;
+        start = ref_strlist_strstrl_mode_(start, sep, &separator);
+        if (!start) {
+            return SIZE_MAX;
+        }
+        start += strlen(separator);
+        ++i;
+        if (i == n) {
+            break;
+        }
+    }
+
+    return start - s;
+}
+
+char * ref_strlist_element_mode(strlist list, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    // Find start
+    const size_t start_pos = ref_strlist_element_position_mode(list, n, sep);
+    if (start_pos == SIZE_MAX) { goto out_of_range; }
+    const char * start = list + start_pos;
+
+    // Find end
+    [[ maybe_unused ]] const char * dummy;
+    const char * end = ref_strlist_strstrl_mode_(start, sep, &dummy);
+    if (!end) {
+        end = start + strlen(start);
+    }
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+strlist ref_strlist_elements_mode(strlist list, size_t from, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * leading_separator;
+    const bool has_leading_separator = !ref_strlist_strstrlcmp_mode_(list, sep, &leading_separator);
+
+    // Find start
+    char * start;
+    if (from == 0) {
+        start = list;
+    } else {
+        const int correction = (has_leading_separator ? strlen(leading_separator) : 0);
+        const size_t start_pos = ref_strlist_element_position_mode(
+            list + correction,
+            from,
+            sep
+        );
+        if (start_pos == SIZE_MAX) { goto out_of_range; }
+        start = list + start_pos + correction;
+    }
+
+    // Find end
+    char * end;
+    do {
+        char * search_end_from = (from == 0 && has_leading_separator
+            ? start + strlen(leading_separator)
+            : start
+        );
+        const size_t end_element_start_pos = ref_strlist_element_position_mode(
+            search_end_from,
+            n ? n-1 : n,
+            sep
+        );
+        if (end_element_start_pos == SIZE_MAX) {
+            const size_t end_pos = strlen(start);
+            memmove(list, start, end_pos);
+            list[end_pos] = '\0';
+            return list;
+        }
+        end = search_end_from + end_element_start_pos;
+        [[ maybe_unused ]] const char * dummy;
+        end = ref_strlist_strstrl_mode_(end, sep, &dummy);
+        if (!end) {
+            end = search_end_from + end_element_start_pos
+                + strlen(search_end_from + end_element_start_pos);
+        }
+    } while (0);
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+// --- Generation
+static uint64_t rng_state;
+
+static uint64_t rng(void) {
+    // xorshift64*
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1DULL;
+}
+
+static size_t rng_below(size_t n) {
+    return n ? rng() % n : 0;
+}
+
+static const char seps_char[] = { ':', '.', '/', 'a', };
+static const char * const seps_str[] = { ":", "::", ":::", ".", "->", };
+static const sep_t seps_strl[] = {
+    (const char * const []){ "::", ":", NULL, },
+    (const char * const []){ ":", "::", NULL, },
+    (const char * const []){ "::", ".", "->", NULL, },
+    (const char * const []){ "->", "-", ">", NULL, },
+    (const char * const []){ ".", NULL, },
+};
+static const sep_mode_t seps_mode[] = {
+    { (const char * const []){ "→", "・", NULL, }, STRLIST_UTF8, },
+    { (const char * const []){ " and ", NULL, }, STRLIST_ICASE, },
+    { (const char * const []){ " AND ", "::", NULL, }, STRLIST_ICASE | STRLIST_UTF8, },
+    { (const char * const []){ "a", "B", NULL, }, STRLIST_ICASE, },
+    { (const char * const []){ "z", "@", "[", "`", "{", NULL, }, STRLIST_ICASE, },
+    // lone continuation byte and truncated "→"; never match in UTF-8 mode
+    { (const char * const []){ "\xA9", ":", NULL, }, STRLIST_UTF8, },
+    { (const char * const []){ "\xE2\x86", NULL, }, STRLIST_UTF8, },
+    { (const char * const []){ "\xE2\x86", "\xA9", NULL, }, STRLIST_EXACT, },
+};
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+/* Every list is placed at a random offset inside a 64 byte aligned buffer,
+ *  so that separators land on all positions relative to a 16/32/64 byte block.
+ */
+#define MAX_LIST 512
+#define ALIGNMENT 64
+static char * place(char * base, size_t offset, const char * s) {
+    char * r = base + offset;
+    strcpy(r, s);
+    return r;
+}
+
+static void gen_random(char * out) {
+    static const char * const pieces[] = {
+        "a", "b", "xyz", ":", "::", ".", "-", ">", "->", "/",
+    };
+    const size_t n = rng_below(64);
+    out[0] = '\0';
+    for (size_t i = 0; i < n; i++) {
+        strcat(out, pieces[rng_below(ARRAY_SIZE(pieces))]);
+    }
+}
+
+/* Filler with separators right before, on and after block boundaries.
+ */
+static void gen_boundary(char * out) {
+    static const size_t boundaries[] = { 16, 32, 64, 128, };
+    static const char * const seps[] = { ":", "::", ".", "->", "/", };
+
+    const size_t len = 1 + rng_below(MAX_LIST / 2);
+    memset(out, 'a' + rng_below(3), len);
+    out[len] = '\0';
+
+    const size_t k = 1 + rng_below(6);
+    for (size_t i = 0; i < k; i++) {
+        const size_t b = boundaries[rng_below(ARRAY_SIZE(boundaries))];
+        const size_t at = b + rng_below(3) - 1 + (rng_below(2) ? 0 : b * rng_below(2));
+        const char * sep = seps[rng_below(ARRAY_SIZE(seps))];
+        if (at + strlen(sep) > len) { continue; }
+        memcpy(out + at, sep, strlen(sep));
+    }
+}
+
+static void gen_adversarial(char * out) {
+    static const char * const cases[] = {
+        "", ":", "::", ":::", "::::", ":a", "a:", ":a:", "::a::", ":::a",
+        ".", "..", "a..b", "->", "-->", "->>", "-->>", "a->->b", "/", "//a//",
+        "a:::b::c:d", "::.->", ".->::", "a-b>c->d",
+    };
+    strcpy(out, cases[rng_below(ARRAY_SIZE(cases))]);
+}
+
+/* Mixed case keywords and multi-byte sequences.
+ */
+static void gen_unicode(char * out) {
+    static const char * const pieces[] = {
+        "a", "B", "xyz", "XYZ", "@[`{", " and ", " AND ", " AnD ", "→", "・", "é", "É", "\xE2\x86", "::", ":",
+    };
+    const size_t n = rng_below(48);
+    out[0] = '\0';
+    for (size_t i = 0; i < n; i++) {
+        strcat(out, pieces[rng_below(ARRAY_SIZE(pieces))]);
+    }
+}
+
+// --- Checking
+static size_t failures = 0;
+
+#define FAIL(...) do { \
+    ++failures; \
+    fprintf(stderr, __VA_ARGS__); \
+    fputc('\n', stderr); \
+} while (0)
+
+static void check_char(char * base, size_t offset, const char * s, char sep) {
+    const size_t len = ref_strlist_len_char(s, sep);
+    const size_t got_len = strlist_len_char(place(base, offset, s), sep);
+    if (got_len != len) {
+        FAIL("len_char(\"%s\", '%c'): %zu != %zu", s, sep, got_len, len);
+    }
+
+    for (size_t n = 0; n < len + 2; n++) {
+        const size_t expected = ref_strlist_element_position_char(s, n, sep);
+        const size_t got = strlist_element_position_char(place(base, offset, s), n, sep);
+        if (got != expected) {
+            FAIL("element_position_char(\"%s\", %zu, '%c'): %zu != %zu", s, n, sep, got, expected);
+        }
+
+        char expected_s[MAX_LIST];
+        strcpy(expected_s, s);
+        ref_strlist_element_char(expected_s, n, sep);
+        const char * got_s = strlist_element_char(place(base, offset, s), n, sep);
+        if (strcmp(got_s, expected_s)) {
+            FAIL("element_char(\"%s\", %zu, '%c'): \"%s\" != \"%s\"", s, n, sep, got_s, expected_s);
+        }
+    }
+
+    for (size_t from = 0; from < len + 2; from++) {
+        for (size_t n = 0; n < len + 2; n++) {
+            char expected_s[MAX_LIST];
+            strcpy(expected_s, s);
+            ref_strlist_elements_char(expected_s, from, n, sep);
+            const char * got_s = strlist_elements_char(place(base, offset, s), from, n, sep);
+            if (strcmp(got_s, expected_s)) {
+                FAIL("elements_char(\"%s\", %zu, %zu, '%c'): \"%s\" != \"%s\"", s, from, n, sep, got_s, expected_s);
+            }
+        }
+    }
+}
+
+static void check_str(char * base, size_t offset, const char * s, const char * sep) {
+    const size_t len = ref_strlist_len_str(s, sep);
+    const size_t got_len = strlist_len_str(place(base, offset, s), sep);
+    if (got_len != len) {
+        FAIL("len_str(\"%s\", \"%s\"): %zu != %zu", s, sep, got_len, len);
+    }
+
+    for (size_t n = 0; n < len + 2; n++) {
+        const size_t expected = ref_strlist_element_position_str(s, n, sep);
+        const size_t got = strlist_element_position_str(place(base, offset, s), n, sep);
+        if (got != expected) {
+            FAIL("element_position_str(\"%s\", %zu, \"%s\"): %zu != %zu", s, n, sep, got, expected);
+        }
+
+        char expected_s[MAX_LIST];
+        strcpy(expected_s, s);
+        ref_strlist_element_str(expected_s, n, sep);
+        const char * got_s = strlist_element_str(place(base, offset, s), n, sep);
+        if (strcmp(got_s, expected_s)) {
+            FAIL("element_str(\"%s\", %zu, \"%s\"): \"%s\" != \"%s\"", s, n, sep, got_s, expected_s);
+        }
+    }
+
+    for (size_t from = 0; from < len + 2; from++) {
+        for (size_t n = 0; n < len + 2; n++) {
+            char expected_s[MAX_LIST];
+            strcpy(expected_s, s);
+            ref_strlist_elements_str(expected_s, from, n, sep);
+            const char * got_s = strlist_elements_str(place(base, offset, s), from, n, sep);
+            if (strcmp(got_s, expected_s)) {
+                FAIL("elements_str(\"%s\", %zu, %zu, \"%s\"): \"%s\" != \"%s\"", s, from, n, sep, got_s, expected_s);
+            }
+        }
+    }
+}
+
+static void check_strl(char * base, size_t offset, const char * s, sep_t sep, size_t sep_i) {
+    const size_t len = ref_strlist_len_strl(s, sep);
+    const size_t got_len = strlist_len_strl(place(base, offset, s), sep);
+    if (got_len != len) {
+        FAIL("len_strl(\"%s\", seps_strl[%zu]): %zu != %zu", s, sep_i, got_len, len);
+    }
+
+    const char * list = place(base, offset, s);
+    for (size_t i = 0; i <= strlen(s); i++) {
+        const char * expected_match = NULL;
+        const char * got_match = NULL;
+        const char * expected = ref_strlist_strstrl_(s + i, sep, &expected_match);
+        const char * got = strlist_strstrl_(list + i, sep, &got_match);
+        if ((expected ? expected - s : -1) != (got ? got - list : -1)
+        ||  expected_match != got_match) {
+            FAIL("strstrl_(\"%s\", seps_strl[%zu]): %td/\"%s\" != %td/\"%s\"",
+                s + i, sep_i,
+                got ? got - list : -1, got_match ? got_match : "",
+                expected ? expected - s : -1, expected_match ? expected_match : ""
+            );
+        }
+    }
+
+    for (size_t n = 0; n < len + 2; n++) {
+        const size_t expected = ref_strlist_element_position_strl(s, n, sep);
+        const size_t got = strlist_element_position_strl(place(base, offset, s), n, sep);
+        if (got != expected) {
+            FAIL("element_position_strl(\"%s\", %zu, seps_strl[%zu]): %zu != %zu", s, n, sep_i, got, expected);
+        }
+
+        char expected_s[MAX_LIST];
+        strcpy(expected_s, s);
+        ref_strlist_element_strl(expected_s, n, sep);
+        const char * got_s = strlist_element_strl(place(base, offset, s), n, sep);
+        if (strcmp(got_s, expected_s)) {
+            FAIL("element_strl(\"%s\", %zu, seps_strl[%zu]): \"%s\" != \"%s\"", s, n, sep_i, got_s, expected_s);
+        }
+    }
+
+    for (size_t from = 0; from < len + 2; from++) {
+        for (size_t n = 0; n < len + 2; n++) {
+            char expected_s[MAX_LIST];
+            strcpy(expected_s, s);
+            ref_strlist_elements_strl(expected_s, from, n, sep);
+            const char * got_s = strlist_elements_strl(place(base, offset, s), from, n, sep);
+            if (strcmp(got_s, expected_s)) {
+                FAIL("elements_strl(\"%s\", %zu, %zu, seps_strl[%zu]): \"%s\" != \"%s\"", s, from, n, sep_i, got_s, expected_s);
+            }
+        }
+    }
+}
+
+/* Every mode is checked against the spec reference;
+ *  in exact mode, that in turn has to agree with the char** reference.
+ */
+static void check_mode(char * base, size_t offset, const char * s, sep_mode_t sep, const char * sep_name) {
+    const char * list = place(base, offset, s);
+    for (size_t i = 0; i <= strlen(s); i++) {
+        const char * expected_match = NULL;
+        const char * got_match = NULL;
+        const char * expected = ref_strlist_strstrl_mode_(s + i, sep, &expected_match);
+        const char * got = strlist_strstrl_mode_(list + i, sep, &got_match);
+        if ((expected ? expected - s : -1) != (got ? got - list : -1)
+        ||  expected_match != got_match) {
+            FAIL("strstrl_mode_(\"%s\", %s): %td/\"%s\" != %td/\"%s\"",
+                s + i, sep_name,
+                got ? got - list : -1, got_match ? got_match : "",
+                expected ? expected - s : -1, expected_match ? expected_match : ""
+            );
+        }
+
+        // The scalar fallback, which SIMD builds never reach otherwise
+        got_match = NULL;
+        got = strlist_strstrl_mode_scalar_(list + i, sep, &got_match);
+        if ((expected ? expected - s : -1) != (got ? got - list : -1)
+        ||  expected_match != got_match) {
+            FAIL("strstrl_mode_scalar_(\"%s\", %s): %td/\"%s\" != %td/\"%s\"",
+                s + i, sep_name,
+                got ? got - list : -1, got_match ? got_match : "",
+                expected ? expected - s : -1, expected_match ? expected_match : ""
+            );
+        }
+
+        expected_match = NULL;
+        got_match = NULL;
+        const int expected_cmp = !ref_strlist_match_mode_(s + i, sep);
+        if (expected_cmp == 0) { expected_match = ref_strlist_match_mode_(s + i, sep); }
+        const int got_cmp = strlist_strstrlcmp_mode_(list + i, sep, &got_match);
+        if (got_cmp != expected_cmp
+        ||  got_match != expected_match) {
+            FAIL("strstrlcmp_mode_(\"%s\", %s): %d != %d", s + i, sep_name, got_cmp, expected_cmp);
+        }
+    }
+
+    const size_t len = ref_strlist_len_mode(s, sep);
+    const size_t got_len = strlist_len_mode(place(base, offset, s), sep);
+    if (got_len != len) {
+        FAIL("len_mode(\"%s\", %s): %zu != %zu", s, sep_name, got_len, len);
+    }
+    if (sep.mode == STRLIST_EXACT && len != ref_strlist_len_strl(s, sep.sep)) {
+        FAIL("len_mode(\"%s\", %s) disagrees with len_strl", s, sep_name);
+    }
+
+    for (size_t n = 0; n < len + 2; n++) {
+        const size_t expected = ref_strlist_element_position_mode(s, n, sep);
+        const size_t got = strlist_element_position_mode(place(base, offset, s), n, sep);
+        if (got != expected) {
+            FAIL("element_position_mode(\"%s\", %zu, %s): %zu != %zu", s, n, sep_name, got, expected);
+        }
+
+        char expected_s[MAX_LIST];
+        strcpy(expected_s, s);
+        ref_strlist_element_mode(expected_s, n, sep);
+        const char * got_s = strlist_element_mode(place(base, offset, s), n, sep);
+        if (strcmp(got_s, expected_s)) {
+            FAIL("element_mode(\"%s\", %zu, %s): \"%s\" != \"%s\"", s, n, sep_name, got_s, expected_s);
+        }
+    }
+
+    for (size_t from = 0; from < len + 2; from++) {
+        for (size_t n = 0; n < len + 2; n++) {
+            char expected_s[MAX_LIST];
+            strcpy(expected_s, s);
+            ref_strlist_elements_mode(expected_s, from, n, sep);
+            const char * got_s = strlist_elements_mode(place(base, offset, s), from, n, sep);
+            if (strcmp(got_s, expected_s)) {
+                FAIL("elements_mode(\"%s\", %zu, %zu, %s): \"%s\" != \"%s\"", s, from, n, sep_name, got_s, expected_s);
+            }
+        }
+    }
+}
+
+static int fuzz(size_t iterations) {
+    char * base = aligned_alloc(ALIGNMENT, MAX_LIST + ALIGNMENT);
+    if (!base) { return 1; }
+
+    for (size_t i = 0; i < iterations && failures < 32; i++) {
+        char s[MAX_LIST];
+        switch (i % 4) {
+            case 0: gen_random(s);      break;
+            case 1: gen_boundary(s);    break;
+            case 2: gen_adversarial(s); break;
+            case 3: gen_unicode(s);     break;
+        }
+        const size_t offset = rng_below(ALIGNMENT);
+
+        for (size_t h = 0; h < ARRAY_SIZE(seps_char); h++) {
+            check_char(base, offset, s, seps_char[h]);
+        }
+        for (size_t h = 0; h < ARRAY_SIZE(seps_str); h++) {
+            check_str(base, offset, s, seps_str[h]);
+        }
+        for (size_t h = 0; h < ARRAY_SIZE(seps_strl); h++) {
+            check_strl(base, offset, s, seps_strl[h], h);
+
+            char sep_name[32];
+            snprintf(sep_name, sizeof(sep_name), "seps_strl[%zu]", h);
+            check_mode(base, offset, s, (sep_mode_t){ seps_strl[h], STRLIST_EXACT, }, sep_name);
+        }
+        for (size_t h = 0; h < ARRAY_SIZE(seps_mode); h++) {
+            char sep_name[32];
+            snprintf(sep_name, sizeof(sep_name), "seps_mode[%zu]", h);
+            check_mode(base, offset, s, seps_mode[h], sep_name);
+        }
+    }
+
+    free(base);
+
+    printf("%zu iterations, %zu failures\n", iterations, failures);
+    return failures != 0;
+}
+
+// --- Throughput
+/* Every round times the library and the reference back to back
+ *  and takes their ratio, so that drifting machine load cancels out.
+ * For the mode rows the reference is the library's own scalar kernel,
+ *  so with STRLIST_NO_SIMD their speedup is 1.
+ * The gate compares the median ratio against the baseline;
+ *  the allowed drop scales with the spread observed in both runs.
+ */
+#define BENCH_SIZE (1 << 20)
+#define BENCH_SEED 0x5EED
+#define BENCH_SECONDS 0.04
+#define BENCH_ROUNDS 11
+#define BENCH_TOLERANCE_MIN 0.05
+#define BENCH_NOISE_FACTOR 2
+
+static volatile size_t sink;
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* Path-ish text: short words joined by some separator.
+ */
+static char * gen_bench(const char * const * seps, size_t seps_n) {
+    char * r = malloc(BENCH_SIZE + 1);
+    if (!r) { return NULL; }
+
+    size_t i = 0;
+    while (true) {
+        const size_t word = 1 + rng_below(16);
+        const char * sep = seps[rng_below(seps_n)];
+        if (i + word + strlen(sep) > BENCH_SIZE) { break; }
+        memset(r + i, 'a' + rng_below(26), word);
+        i += word;
+        memcpy(r + i, sep, strlen(sep));
+        i += strlen(sep);
+    }
+    r[i] = '\0';
+    return r;
+}
+
+/* Mixed case words, every 8th with a multi-byte codepoint,
+ *  joined by mixed case keywords and arrows;
+ *  so that both the ASCII and the non-ASCII block paths are hit.
+ */
+static char * gen_bench_mixed(void) {
+    static const char * const seps[] = { " and ", " AND ", " And ", "→", };
+
+    char * r = malloc(BENCH_SIZE + 1);
+    if (!r) { return NULL; }
+
+    size_t i = 0;
+    while (true) {
+        const size_t word = 1 + rng_below(16);
+        const char * sep = seps[rng_below(ARRAY_SIZE(seps))];
+        if (i + word + strlen("é") + strlen(sep) > BENCH_SIZE) { break; }
+        for (size_t h = 0; h < word; h++) {
+            r[i++] = (rng_below(2) ? 'a' : 'A') + rng_below(26);
+        }
+        if (rng_below(8) == 0) {
+            memcpy(r + i, "é", strlen("é"));
+            i += strlen("é");
+        }
+        memcpy(r + i, sep, strlen(sep));
+        i += strlen(sep);
+    }
+    r[i] = '\0';
+    return r;
+}
+
+typedef enum { KERNEL_LEN, KERNEL_POSITION, KERNEL_ELEMENTS, } kernel_t;
+
+/* Runs one kernel over the whole bench list until BENCH_SECONDS elapse,
+ *  returning MB/s.
+ */
+#define DEFINE_BENCH(variant, sep_type) \
+    static double bench_##variant(                                                      \
+        kernel_t kernel,                                                                \
+        size_t  (*len_f)(cstrlist, sep_type),                                           \
+        size_t  (*position_f)(cstrlist, size_t, sep_type),                              \
+        strlist (*elements_f)(strlist, size_t, size_t, sep_type),                       \
+        cstrlist list,                                                                  \
+        strlist scratch,                                                                \
+        sep_type sep                                                                    \
+    ) {                                                                                 \
+        const size_t list_len = strlen(list);                                           \
+        const size_t n = len_f(list, sep);                                              \
+        size_t bytes = 0;                                                               \
+        const double start = now();                                                     \
+        double elapsed;                                                                 \
+        do {                                                                            \
+            switch (kernel) {                                                           \
+                case KERNEL_LEN:                                                        \
+                    sink += len_f(list, sep);                                           \
+                    break;                                                              \
+                case KERNEL_POSITION:                                                   \
+                    sink += position_f(list, n - 1, sep);                               \
+                    break;                                                              \
+                case KERNEL_ELEMENTS:                                                   \
+                    memcpy(scratch, list, list_len + 1);                                \
+                    sink += elements_f(scratch, 1, n - 2, sep)[0];                      \
+                    break;                                                              \
+            }                                                                           \
+            bytes += list_len;                                                          \
+            elapsed = now() - start;                                                    \
+        } while (elapsed < BENCH_SECONDS);                                              \
+        return bytes / elapsed / 1e6;                                                   \
+    }
+
+DEFINE_BENCH(char, char)
+DEFINE_BENCH(str,  const char *)
+DEFINE_BENCH(strl, sep_t)
+DEFINE_BENCH(mode, sep_mode_t)
+
+/* The mode API over the library's own scalar kernel,
+ *  so that the mode rows measure what the SIMD kernel buys.
+ */
+size_t scalar_strlist_len_mode(cstrlist list, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * s = list;
+
+    if (s[0] == '\0') { return 0; }
+
+    do {
+        const char * first_sep;
+        if (!strlist_strstrlcmp_mode_(s, sep, &first_sep)) {
+            s += strlen(first_sep);
+        }
+    } while (0);
+
+    size_t r = 1;
+    const char * separator;
+    while ((s = strlist_strstrl_mode_scalar_(s, sep, &separator))) {
+        s += strlen(separator);
+        ++r;
+    }
+    return r;
+}
+
+size_t scalar_strlist_element_position_mode(cstrlist list, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * s = list;
+
+    if (n == 0) { return 0; }
+
+    size_t i = 0;
+
+    const char * start = s;
+    while (true) {
+        const char * separator;
+        start = strlist_strstrl_mode_scalar_(start, sep, &separator);
+        if (!start) {
+            return SIZE_MAX;
+        }
+        start += strlen(separator);
+        ++i;
+        if (i == n) {
+            break;
+        }
+    }
+
+    return start - s;
+}
+
+strlist scalar_strlist_elements_mode(strlist list, size_t from, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * leading_separator;
+    const bool has_leading_separator = !strlist_strstrlcmp_mode_(list, sep, &leading_separator);
+
+    // Find start
+    char * start;
+    if (from == 0) {
+        start = list;
+    } else {
+        const int correction = (has_leading_separator ? strlen(leading_separator) : 0);
+        const size_t start_pos = scalar_strlist_element_position_mode(
+            list + correction,
+            from,
+            sep
+        );
+        if (start_pos == SIZE_MAX) { goto out_of_range; }
+        start = list + start_pos + correction;
+    }
+
+    // Find end
+    char * end;
+    do {
+        char * search_end_from = (from == 0 && has_leading_separator
+            ? start + strlen(leading_separator)
+            : start
+        );
+        const size_t end_element_start_pos = scalar_strlist_element_position_mode(
+            search_end_from,
+            n ? n-1 : n,
+            sep
+        );
+        if (end_element_start_pos == SIZE_MAX) {
+            const size_t end_pos = strlen(start);
+            memmove(list, start, end_pos);
+            list[end_pos] = '\0';
+            return list;
+        }
+        end = search_end_from + end_element_start_pos;
+        [[ maybe_unused ]] const char * dummy;
+        end = strlist_strstrl_mode_scalar_(end, sep, &dummy);
+        if (!end) {
+            end = search_end_from + end_element_start_pos
+                + strlen(search_end_from + end_element_start_pos);
+        }
+    } while (0);
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+typedef struct {
+    char name[32];
+    double lib;
+    double ref;
+    double speedup;
+    double noise; // relative median absolute deviation of the speedup
+} bench_result_t;
+
+static int compare_double(const void * a, const void * b) {
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double median(double * v, size_t n) {
+    qsort(v, n, sizeof(*v), compare_double);
+    return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+/* Baseline rows are previous -b output lines.
+ */
+static size_t read_baseline(const char * path, bench_result_t * rows, size_t rows_max) {
+    FILE * f = fopen(path, "r");
+    if (!f) { return SIZE_MAX; }
+
+    char line[256];
+    size_t n = 0;
+    while (n < rows_max && fgets(line, sizeof(line), f)) {
+        bench_result_t * row = rows + n;
+        if (sscanf(line, "%31s %lf %lf %lfx +-%lf%%", row->name, &row->lib, &row->ref, &row->speedup, &row->noise) == 5
+        &&  row->name[0] != '#') {
+            row->noise /= 100;
+            ++n;
+        }
+    }
+
+    fclose(f);
+    return n;
+}
+
+static const bench_result_t * find_row(const bench_result_t * rows, size_t rows_n, const char * name) {
+    for (size_t i = 0; i < rows_n; i++) {
+        if (!strcmp(rows[i].name, name)) { return rows + i; }
+    }
+
+    return NULL;
+}
+
+static int bench(const char * baseline) {
+    static const char * const str_seps[] = { "\\n\\r", };
+    static const char * const strl_seps[] = { "::", ".", "->", };
+    sep_t strl_sep = (const char * const []){ "::", ".", "->", NULL, };
+    sep_mode_t mode_sep = { strl_sep, STRLIST_ICASE | STRLIST_UTF8, };
+    sep_mode_t mixed_sep = strlist_sep_mode(STRLIST_ICASE | STRLIST_UTF8, " and ", "→");
+
+    static const char * const kernel_names[3] = { "len", "element_position", "elements", };
+    enum { VARIANTS = 5, RESULTS = VARIANTS * ARRAY_SIZE(kernel_names), };
+
+    bench_result_t baseline_rows[64];
+    size_t baseline_n = 0;
+    if (baseline) {
+        baseline_n = read_baseline(baseline, baseline_rows, ARRAY_SIZE(baseline_rows));
+        if (baseline_n == SIZE_MAX) {
+            fprintf(stderr, "Cannot read baseline '%s'.\n", baseline);
+            return 2;
+        }
+    }
+
+    // The same lists on every run, so that runs are comparable
+    rng_state = BENCH_SEED;
+    char * char_list = gen_bench((const char * const []){ "/", }, 1);
+    char * str_list  = gen_bench(str_seps, ARRAY_SIZE(str_seps));
+    char * strl_list = gen_bench(strl_seps, ARRAY_SIZE(strl_seps));
+    char * mixed_list = gen_bench_mixed();
+    char * scratch   = malloc(BENCH_SIZE + 1);
+    if (!char_list || !str_list || !strl_list || !mixed_list || !scratch) { return 1; }
+
+    bench_result_t results[RESULTS];
+    double lib[RESULTS][BENCH_ROUNDS];
+    double ref[RESULTS][BENCH_ROUNDS];
+    double speedup[RESULTS][BENCH_ROUNDS];
+
+    // Rounds are interleaved across kernels to spread out bursts of noise
+    for (size_t round = 0; round < BENCH_ROUNDS; round++) {
+        size_t i = 0;
+        for (kernel_t k = KERNEL_LEN; k <= KERNEL_ELEMENTS; k++) {
+            const struct { const char * suffix; double lib, ref; } round_results[VARIANTS] = {
+                {
+                    "_char",
+                    bench_char(k, strlist_len_char, strlist_element_position_char, strlist_elements_char, char_list, scratch, '/'),
+                    bench_char(k, ref_strlist_len_char, ref_strlist_element_position_char, ref_strlist_elements_char, char_list, scratch, '/'),
+                },
+                {
+                    "_str",
+                    bench_str(k, strlist_len_str, strlist_element_position_str, strlist_elements_str, str_list, scratch, "\\n\\r"),
+                    bench_str(k, ref_strlist_len_str, ref_strlist_element_position_str, ref_strlist_elements_str, str_list, scratch, "\\n\\r"),
+                },
+                {
+                    "_strl",
+                    bench_strl(k, strlist_len_strl, strlist_element_position_strl, strlist_elements_strl, strl_list, scratch, strl_sep),
+                    bench_strl(k, ref_strlist_len_strl, ref_strlist_element_position_strl, ref_strlist_elements_strl, strl_list, scratch, strl_sep),
+                },
+                {
+                    "_mode",
+                    bench_mode(k, strlist_len_mode, strlist_element_position_mode, strlist_elements_mode, strl_list, scratch, mode_sep),
+                    bench_mode(k, scalar_strlist_len_mode, scalar_strlist_element_position_mode, scalar_strlist_elements_mode, strl_list, scratch, mode_sep),
+                },
+                {
+                    "_mode_mixed",
+                    bench_mode(k, strlist_len_mode, strlist_element_position_mode, strlist_elements_mode, mixed_list, scratch, mixed_sep),
+                    bench_mode(k, scalar_strlist_len_mode, scalar_strlist_element_position_mode, scalar_strlist_elements_mode, mixed_list, scratch, mixed_sep),
+                },
+            };
+            for (size_t h = 0; h < ARRAY_SIZE(round_results); h++, i++) {
+                snprintf(results[i].name, sizeof(results[i].name), "%s%s", kernel_names[k], round_results[h].suffix);
+                lib[i][round] = round_results[h].lib;
+                ref[i][round] = round_results[h].ref;
+                speedup[i][round] = round_results[h].lib / round_results[h].ref;
+            }
+        }
+    }
+
+    int r = 0;
+    printf("%-28s %12s %12s %8s %8s\n", "# kernel", "lib MB/s", "ref MB/s", "speedup", "noise");
+    for (size_t i = 0; i < RESULTS; i++) {
+        results[i].lib = median(lib[i], BENCH_ROUNDS);
+        results[i].ref = median(ref[i], BENCH_ROUNDS);
+        results[i].speedup = median(speedup[i], BENCH_ROUNDS);
+
+        double deviation[BENCH_ROUNDS];
+        for (size_t h = 0; h < BENCH_ROUNDS; h++) {
+            const double d = speedup[i][h] - results[i].speedup;
+            deviation[h] = (d < 0 ? -d : d);
+        }
+        results[i].noise = median(deviation, BENCH_ROUNDS) / results[i].speedup;
+
+        printf("%-28s %12.1f %12.1f %7.2fx +-%5.1f%%",
+            results[i].name, results[i].lib, results[i].ref, results[i].speedup, results[i].noise * 100
+        );
+
+        if (baseline) {
+            const bench_result_t * expected = find_row(baseline_rows, baseline_n, results[i].name);
+            if (!expected) {
+                printf("  # MISSING FROM BASELINE");
+                r = 2;
+            } else {
+                double tolerance = BENCH_NOISE_FACTOR * (results[i].noise + expected->noise);
+                if (tolerance < BENCH_TOLERANCE_MIN) { tolerance = BENCH_TOLERANCE_MIN; }
+                if (results[i].speedup < expected->speedup * (1 - tolerance)) {
+                    printf("  # REGRESSION (baseline %.2fx, tolerance %.0f%%)", expected->speedup, tolerance * 100);
+                    if (!r) { r = 1; }
+                }
+            }
+        }
+        putchar('\n');
+    }
+
+    free(char_list);
+    free(str_list);
+    free(strl_list);
+    free(mixed_list);
+    free(scratch);
+
+    return r;
+}
+
+// ---
+signed main(int argc, char * argv[]) {
+    uint64_t seed = time(NULL);
+    size_t iterations = 500;
+    bool do_bench = false;
+    const char * baseline = NULL;
+
+    for (int opt; (opt = getopt(argc, argv, "s:i:bB:")) != -1; ) {
+        switch (opt) {
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'i': iterations = strtoull(optarg, NULL, 0); break;
+            case 'b': do_bench = true; break;
+            case 'B': baseline = optarg; do_bench = true; break;
+            default:
+                fprintf(stderr, "Usage: %s [-s seed] [-i iterations] [-b] [-B baseline]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    // xorshift is stuck at 0
+    rng_state = seed ? seed : 1;
+
+    if (do_bench) { return bench(baseline); }
+
+    printf("seed: %llu\n", (unsigned long long)seed);
+    return fuzz(iterations);
+}
@@ -3,9 +3,15 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
+#if defined(__SSE2__) && !defined(STRLIST_NO_SIMD)
+# include <emmintrin.h>
+# define STRLIST_SSE2
+#endif
+
 /* String list library.
  * A string list is a list encoded as a string, delimited by some token.
  */
@@ -31,6 +37,42 @@ size_t  strlist_element_position_strl(cstrlist list, size_t n, sep_t sep);
 char *  strlist_element_strl(strlist list, size_t n, sep_t sep);
 strlist strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep);
 
+// Matching mode variants
+typedef struct {
+    sep_t sep;
+    unsigned mode;
+} sep_mode_t;
+#define STRLIST_EXACT 0
+#define STRLIST_ICASE (1 << 0) // ASCII case folding
+#define STRLIST_UTF8  (1 << 1) // only match on codepoint boundaries
+#define strlist_sep_mode(mode_, ...) ((sep_mode_t){ (const char * const []){ __VA_ARGS__, NULL, }, mode_ })
+size_t  strlist_len_mode(cstrlist list, sep_mode_t sep);
+size_t  strlist_element_position_mode(cstrlist list, size_t n, sep_mode_t sep);
+char *  strlist_element_mode(strlist list, size_t n, sep_mode_t sep);
+strlist strlist_elements_mode(strlist list, size_t from, size_t n, sep_mode_t sep);
+
+// Map / filter
+typedef struct {
+    const char * data;
+    size_t len;
+} strlist_span;
+
+/* Map callbacks write the transformed element to `out` and return its length,
+ *  or STRLIST_DROP to leave it out of the result.
+ */
+#define STRLIST_DROP SIZE_MAX
+typedef size_t (*strlist_map_fn)(strlist_span element, char * out, void * data);
+typedef bool   (*strlist_filter_fn)(strlist_span element, void * data);
+
+strlist strlist_map_char(cstrlist list, char sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data);
+strlist strlist_map_str(cstrlist list, const char * sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data);
+strlist strlist_map_strl(cstrlist list, sep_t sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data);
+strlist strlist_filter_char(cstrlist list, char sep, const char * out_sep, strlist_filter_fn f, void * data);
+strlist strlist_filter_str(cstrlist list, const char * sep, const char * out_sep, strlist_filter_fn f, void * data);
+strlist strlist_filter_strl(cstrlist list, sep_t sep, const char * out_sep, strlist_filter_fn f, void * data);
+strlist strlist_map_mode(cstrlist list, sep_mode_t sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data);
+strlist strlist_filter_mode(cstrlist list, sep_mode_t sep, const char * out_sep, strlist_filter_fn f, void * data);
+
 // --- Generics
 #define strlist_len(list, sep) \
     _Generic(sep                         \
@@ -39,8 +81,19 @@ strlist strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep);
         , char*       : strlist_len_str  \
         , const char* : strlist_len_str  \
         , sep_t       : strlist_len_strl \
+        , sep_mode_t  : strlist_len_mode \
     )(list, sep)
 
+#define strlist_element_position(list, n, sep) \
+    _Generic(sep                                      \
+        , int         : strlist_element_position_char \
+        , char        : strlist_element_position_char \
+        , char*       : strlist_element_position_str  \
+        , const char* : strlist_element_position_str  \
+        , sep_t       : strlist_element_position_strl \
+        , sep_mode_t  : strlist_element_position_mode \
+    )(list, n, sep)
+
 /* This function in an abstract sense performs list indexing.
  *  The result overwrites the `list` argument and is returned.
  *  (We know that this may never result in an overflow.)
@@ -52,6 +105,7 @@ strlist strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep);
         , char*       : strlist_element_str  \
         , const char* : strlist_element_str  \
         , sep_t       : strlist_element_strl \
+        , sep_mode_t  : strlist_element_mode \
     )(list, n, sep)
 
 /* This function returns a range.
@@ -63,6 +117,7 @@ strlist strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep);
         , char*       : strlist_elements_str  \
         , const char* : strlist_elements_str  \
         , sep_t       : strlist_elements_strl \
+        , sep_mode_t  : strlist_elements_mode \
     )(list, from, n, sep)
 
 /* The following are shorthands for elements(),
@@ -93,6 +148,44 @@ strlist strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep);
     strlist_elements(list, 1, _strlist_len_tmp ? _strlist_len_tmp-1 : 0, sep) \
 )
 
+/* Map / filter
+ *
+ * Unlike the functions above, these do take a new buffer:
+ *  a mapped list may outgrow its source.
+ *  The result is allocated exactly once and must be free()-d;
+ *  NULL is returned if the allocation fails.
+ *
+ * `growth` is the most bytes a single map callback may add to its element;
+ *  `out` is guaranteed to hold `element.len + growth` bytes.
+ *  (NULL is also returned if that bound does not fit a size_t.)
+ *
+ * The list is split in a single pass, without counting its elements first;
+ *  the buffer is sized for the most elements a list of that length could hold
+ *  (every shortest separator), so expect it to be over-allocated.
+ *
+ * A leading separator is kept (as `out_sep`), just like elements() keeps it,
+ *  unless every element is dropped.
+ */
+#define strlist_map(list, sep, out_sep, f, growth, data) \
+    _Generic(sep                         \
+        , int         : strlist_map_char \
+        , char        : strlist_map_char \
+        , char*       : strlist_map_str  \
+        , const char* : strlist_map_str  \
+        , sep_t       : strlist_map_strl \
+        , sep_mode_t  : strlist_map_mode \
+    )(list, sep, out_sep, f, growth, data)
+
+#define strlist_filter(list, sep, out_sep, f, data) \
+    _Generic(sep                            \
+        , int         : strlist_filter_char \
+        , char        : strlist_filter_char \
+        , char*       : strlist_filter_str  \
+        , const char* : strlist_filter_str  \
+        , sep_t       : strlist_filter_strl \
+        , sep_mode_t  : strlist_filter_mode \
+    )(list, sep, out_sep, f, data)
+
 /* Iteration
  *
  * While individual operations are reasonably fast,
@@ -121,18 +214,22 @@ strlist strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep);
     iter.n = strlist_len(list_, sep_)                            \
 )
 
+/* The next offset is taken before terminating the element,
+ *  as that overwrites the separator, whose length is not known in general.
+ */
 #define strlist_iterator_next(iter) ( \
-    iter.i == iter.n                                                                \
-        ? NULL                                                                      \
-        :                                                                           \
-            (                                                                       \
-                strlist_element(iter.mutable_copy + iter.next_offset, 0, iter.sep), \
-                iter.offset = iter.next_offset,                                     \
-                iter.next_offset += strlen(iter.mutable_copy + iter.offset) + 1,    \
-                ++iter.i,                                                           \
-                iter.mutable_copy + iter.offset                                     \
-            )                                                                       \
-)                                                                                   \
+    iter.i == iter.n                                                                          \
+        ? NULL                                                                                \
+        :                                                                                     \
+            (                                                                                 \
+                iter.offset = iter.next_offset,                                               \
+                iter.next_offset = iter.offset                                                \
+                    + strlist_element_position(iter.mutable_copy + iter.offset, 1, iter.sep), \
+                strlist_element(iter.mutable_copy + iter.offset, 0, iter.sep),                \
+                ++iter.i,                                                                     \
+                iter.mutable_copy + iter.offset                                               \
+            )                                                                                 \
+)                                                                                             \
 
 #define foreach_strlist(list, sep, i_) \
     for (                                                                 \
@@ -574,4 +671,434 @@ strlist strlist_elements_strl(strlist list, size_t from, size_t n, sep_t sep) {
     return list;
 }
 
+// --- Matching modes
+/* Possible examples (at block scope, compound literals are not constant expressions):
+ *   sep_mode_t arrow_sep = strlist_sep_mode(STRLIST_UTF8, "→", "・");
+ *   sep_mode_t and_sep   = strlist_sep_mode(STRLIST_ICASE, " and ");
+ *
+ * Case folding is ASCII only, the input is never copied.
+ * In UTF-8 mode, a separator may neither start nor end inside a multi-byte sequence.
+ */
+char strlist_fold_(char c, unsigned mode) {
+    return (mode & STRLIST_ICASE) && c >= 'A' && c <= 'Z'
+        ? c + ('a' - 'A')
+        : c
+    ;
+}
+
+bool strlist_is_continuation_(char c) {
+    return ((unsigned char)c & 0xC0) == 0x80;
+}
+
+/* Returns the first separator (in array order) which `s` starts with.
+ */
+const char * strlist_match_mode_(const char * s, sep_mode_t sep) {
+    if ((sep.mode & STRLIST_UTF8) && strlist_is_continuation_(s[0])) { return NULL; }
+
+    for (auto w = sep.sep; *w != NULL; w++) {
+        size_t i = 0;
+        while ((*w)[i] != '\0'
+        &&     strlist_fold_(s[i], sep.mode) == strlist_fold_((*w)[i], sep.mode)) {
+            ++i;
+        }
+        if ((*w)[i] != '\0') { continue; }
+        if ((sep.mode & STRLIST_UTF8) && strlist_is_continuation_(s[i])) { continue; }
+        return *w;
+    }
+
+    return NULL;
+}
+
+int strlist_strstrlcmp_mode_(const char * s, sep_mode_t sep, const char * * match) {
+    const char * w = strlist_match_mode_(s, sep);
+    if (!w) { return 1; }
+
+    *match = w;
+    return 0;
+}
+
+char * strlist_strstrl_mode_scalar_(const char * s, sep_mode_t sep, const char * * match) {
+    for (const char * p = s; *p != '\0'; p++) {
+        const char * w = strlist_match_mode_(p, sep);
+        if (w) {
+            *match = w;
+            return (char *)p;
+        }
+    }
+
+    return NULL;
+}
+
+#ifdef STRLIST_SSE2
+__m128i strlist_fold_sse2_(__m128i v) {
+    // 'A'..'Z' are the only bytes to land below -128+26 after the shift
+    const __m128i shifted  = _mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - 'A')));
+    const __m128i is_upper = _mm_cmplt_epi8(shifted, _mm_set1_epi8(-128 + 26));
+    return _mm_or_si128(v, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+}
+
+/* Scans aligned 16 byte blocks, which never cross a page,
+ *  so reading past the terminator is harmless (but invisible to ASan).
+ * Candidates are positions holding the (folded) first byte of some separator,
+ *  each verified by strlist_match_mode_().
+ * UTF-8 mode needs no separate path for non-ASCII blocks:
+ *  a separator starting with an ASCII or lead byte never has a candidate on a continuation byte,
+ *  the verification rejects the rest and checks the end boundary.
+ */
+[[ gnu::no_sanitize_address ]]
+char * strlist_strstrl_mode_(const char * s, sep_mode_t sep, const char * * match) {
+    size_t seps_n = 0;
+    while (sep.sep[seps_n] != NULL) { ++seps_n; }
+    if (seps_n == 0) { return NULL; }
+
+    // Distinct first bytes, broadcast once
+    char first_bytes[seps_n];
+    __m128i firsts[seps_n];
+    size_t firsts_n = 0;
+    for (size_t i = 0; i < seps_n; i++) {
+        const char c = strlist_fold_(sep.sep[i][0], sep.mode);
+        if (memchr(first_bytes, c, firsts_n)) { continue; }
+        first_bytes[firsts_n] = c;
+        firsts[firsts_n] = _mm_set1_epi8(c);
+        ++firsts_n;
+    }
+
+    const size_t misalign = (uintptr_t)s % 16;
+    const char * block = s - misalign;
+    unsigned valid = (0xFFFF << misalign) & 0xFFFF;
+
+    for (;; block += 16, valid = 0xFFFF) {
+        const __m128i raw = _mm_load_si128((const __m128i *)block);
+        const __m128i folded = (sep.mode & STRLIST_ICASE ? strlist_fold_sse2_(raw) : raw);
+
+        const unsigned terminator = _mm_movemask_epi8(_mm_cmpeq_epi8(raw, _mm_setzero_si128())) & valid;
+        const unsigned live = (terminator ? valid & ((terminator & -terminator) - 1) : valid);
+
+        __m128i candidates = _mm_setzero_si128();
+        for (size_t i = 0; i < firsts_n; i++) {
+            candidates = _mm_or_si128(candidates, _mm_cmpeq_epi8(folded, firsts[i]));
+        }
+        for (unsigned m = _mm_movemask_epi8(candidates) & live; m; m &= m - 1) {
+            const char * p = block + __builtin_ctz(m);
+            const char * w = strlist_match_mode_(p, sep);
+            if (w) {
+                *match = w;
+                return (char *)p;
+            }
+        }
+
+        if (terminator) { return NULL; }
+    }
+}
+#else
+char * strlist_strstrl_mode_(const char * s, sep_mode_t sep, const char * * match) {
+    return strlist_strstrl_mode_scalar_(s, sep, match);
+}
+#endif
+
+size_t strlist_len_mode(cstrlist list, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * s = list;
+
+    if (s[0] == '\0') { return 0; }
+
+    do {
+        const char * first_sep;
+        if (!strlist_strstrlcmp_mode_(s, sep, &first_sep)) {
+            s += strlen(first_sep);
+        }
+    } while (0);
+
+    size_t r = 1;
+    const char * separator;
+    while ((s = strlist_strstrl_mode_(s, sep, &separator))) {
+        s += strlen(separator);
+        ++r;
+    }
+    return r;
+}
+
+size_t strlist_element_position_mode(cstrlist list, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * s = list;
+
+    if (n == 0) { return 0; }
+
+    size_t i = 0;
+
+    const char * start = s;
+    while (true) {
+        const char * separator;
+        start = strlist_strstrl_mode_(start, sep, &separator);
+        if (!start) {
+            return SIZE_MAX;
+        }
+        start += strlen(separator);
+        ++i;
+        if (i == n) {
+            break;
+        }
+    }
+
+    return start - s;
+}
+
+char * strlist_element_mode(strlist list, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    // Find start
+    const size_t start_pos = strlist_element_position_mode(list, n, sep);
+    if (start_pos == SIZE_MAX) { goto out_of_range; }
+    const char * start = list + start_pos;
+
+    // Find end
+    [[ maybe_unused ]] const char * dummy;
+    const char * end = strlist_strstrl_mode_(start, sep, &dummy);
+    if (!end) {
+        end = start + strlen(start);
+    }
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+strlist strlist_elements_mode(strlist list, size_t from, size_t n, sep_mode_t sep) {
+    assert(list);
+    assert(sep.sep);
+
+    const char * leading_separator;
+    const bool has_leading_separator = !strlist_strstrlcmp_mode_(list, sep, &leading_separator);
+
+    // Find start
+    char * start;
+    if (from == 0) {
+        start = list;
+    } else {
+        const int correction = (has_leading_separator ? strlen(leading_separator) : 0);
+        const size_t start_pos = strlist_element_position_mode(
+            list + correction,
+            from,
+            sep
+        );
+        if (start_pos == SIZE_MAX) { goto out_of_range; }
+        start = list + start_pos + correction;
+    }
+
+    // Find end
+    char * end;
+    do {
+        char * search_end_from = (from == 0 && has_leading_separator
+            ? start + strlen(leading_separator)
+            : start
+        );
+        const size_t end_element_start_pos = strlist_element_position_mode(
+            search_end_from,
+            n ? n-1 : n,
+            sep
+        );
+        if (end_element_start_pos == SIZE_MAX) {
+            const size_t end_pos = strlen(start);
+            memmove(list, start, end_pos);
+            list[end_pos] = '\0';
+            return list;
+        }
+        end = search_end_from + end_element_start_pos;
+        [[ maybe_unused ]] const char * dummy;
+        end = strlist_strstrl_mode_(end, sep, &dummy);
+        if (!end) {
+            end = search_end_from + end_element_start_pos
+                + strlen(search_end_from + end_element_start_pos);
+        }
+    } while (0);
+
+    // Finalize
+    memmove(list, start, end - start);
+    list[end - start] = '\0';
+    return list;
+
+  out_of_range:
+    list[0] = '\0';
+    return list;
+}
+
+// --- Map / filter
+/* Upper bound of a mapped list; the leading separator takes the extra slot.
+ * Returns SIZE_MAX if the bound is not representable.
+ */
+size_t strlist_map_capacity_(size_t list_len, size_t n, size_t out_sep_len, size_t growth) {
+    const size_t slot = out_sep_len + growth;
+    if (slot < growth) { return SIZE_MAX; }
+    if (list_len >= SIZE_MAX - 1) { return SIZE_MAX; }
+    if (slot && n + 1 > (SIZE_MAX - list_len - 1) / slot) { return SIZE_MAX; }
+
+    return list_len + (n + 1) * slot + 1;
+}
+
+/* Appends a single (possibly dropped) element to the output.
+ * The separator is written speculatively and simply not committed on drop.
+ * `separate` starts out true only for lists with a leading separator,
+ *  so that it is kept if and only if some element is.
+ */
+char * strlist_map_emit_(char * w, bool * separate, strlist_span e, const char * out_sep, strlist_map_fn f, void * data) {
+    const size_t out_sep_len = (*separate ? strlen(out_sep) : 0);
+    memcpy(w, out_sep, out_sep_len);
+
+    const size_t written = f(e, w + out_sep_len, data);
+    if (written == STRLIST_DROP) { return w; }
+
+    *separate = true;
+    return w + out_sep_len + written;
+}
+
+/* Separator finders; the very kernels element_position() advances with,
+ *  but also reporting where the separator starts, which a span needs.
+ */
+typedef const char * (*strlist_find_fn_)(const char * s, const void * sep, size_t * sep_len);
+
+const char * strlist_find_char_(const char * s, const void * sep, size_t * sep_len) {
+    *sep_len = 1;
+    return strchr(s, *(const char *)sep);
+}
+
+const char * strlist_find_str_(const char * s, const void * sep, size_t * sep_len) {
+    *sep_len = strlen(*(const char * const *)sep);
+    return strstr(s, *(const char * const *)sep);
+}
+
+const char * strlist_find_strl_(const char * s, const void * sep, size_t * sep_len) {
+    const char * match;
+    const char * r = strlist_strstrl_(s, *(const sep_t *)sep, &match);
+    if (r) { *sep_len = strlen(match); }
+    return r;
+}
+
+const char * strlist_find_mode_(const char * s, const void * sep, size_t * sep_len) {
+    const char * match;
+    const char * r = strlist_strstrl_mode_(s, *(const sep_mode_t *)sep, &match);
+    if (r) { *sep_len = strlen(match); }
+    return r;
+}
+
+size_t strlist_min_len_(sep_t sep) {
+    size_t r = SIZE_MAX;
+    for (auto w = sep; *w != NULL; w++) {
+        if (strlen(*w) < r) { r = strlen(*w); }
+    }
+    return r;
+}
+
+/* Single pass over the list; every separator is found exactly once.
+ * There can be no more elements than separators of `min_sep_len` fitting the list, plus one,
+ *  which is what the buffer is sized for.
+ */
+strlist strlist_map_(cstrlist list, strlist_find_fn_ find, const void * sep, size_t min_sep_len, const char * out_sep, strlist_map_fn f, size_t growth, void * data) {
+    assert(list);
+    assert(out_sep);
+    assert(f);
+
+    const size_t list_len = strlen(list);
+    const size_t n = list_len / (min_sep_len ? min_sep_len : 1) + 1;
+    const size_t capacity = strlist_map_capacity_(list_len, n, strlen(out_sep), growth);
+    if (capacity == SIZE_MAX) { return NULL; }
+    strlist r = malloc(capacity);
+    if (!r) { return NULL; }
+
+    char * w = r;
+    const char * s = list;
+
+    if (s[0] == '\0') { goto out; }
+
+    size_t sep_len;
+    const char * end = find(s, sep, &sep_len);
+
+    bool separate = false;
+    if (end == s) {
+        separate = true;
+        s += sep_len;
+        end = find(s, sep, &sep_len);
+    }
+
+    while (true) {
+        const size_t len = (end ? (size_t)(end - s) : strlen(s));
+        w = strlist_map_emit_(w, &separate, (strlist_span){ s, len }, out_sep, f, data);
+        if (!end) { break; }
+        s = end + sep_len;
+        end = find(s, sep, &sep_len);
+    }
+
+  out:
+    *w = '\0';
+    return r;
+}
+
+strlist strlist_map_char(cstrlist list, char sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data) {
+    return strlist_map_(list, strlist_find_char_, &sep, 1, out_sep, f, growth, data);
+}
+
+strlist strlist_map_str(cstrlist list, const char * sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data) {
+    assert(sep);
+    return strlist_map_(list, strlist_find_str_, &sep, strlen(sep), out_sep, f, growth, data);
+}
+
+strlist strlist_map_strl(cstrlist list, sep_t sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data) {
+    assert(sep);
+    return strlist_map_(list, strlist_find_strl_, &sep, strlist_min_len_(sep), out_sep, f, growth, data);
+}
+
+strlist strlist_map_mode(cstrlist list, sep_mode_t sep, const char * out_sep, strlist_map_fn f, size_t growth, void * data) {
+    assert(sep.sep);
+    return strlist_map_(list, strlist_find_mode_, &sep, strlist_min_len_(sep.sep), out_sep, f, growth, data);
+}
+
+/* Filtering is mapping with the identity function and a zero growth.
+ */
+typedef struct {
+    strlist_filter_fn f;
+    void * data;
+} strlist_filter_closure_;
+
+size_t strlist_filter_map_(strlist_span element, char * out, void * data) {
+    const strlist_filter_closure_ * c = data;
+
+    if (!c->f(element, c->data)) { return STRLIST_DROP; }
+
+    memcpy(out, element.data, element.len);
+    return element.len;
+}
+
+strlist strlist_filter_char(cstrlist list, char sep, const char * out_sep, strlist_filter_fn f, void * data) {
+    assert(f);
+    strlist_filter_closure_ c = { f, data };
+    return strlist_map_char(list, sep, out_sep, strlist_filter_map_, 0, &c);
+}
+
+strlist strlist_filter_str(cstrlist list, const char * sep, const char * out_sep, strlist_filter_fn f, void * data) {
+    assert(f);
+    strlist_filter_closure_ c = { f, data };
+    return strlist_map_str(list, sep, out_sep, strlist_filter_map_, 0, &c);
+}
+
+strlist strlist_filter_strl(cstrlist list, sep_t sep, const char * out_sep, strlist_filter_fn f, void * data) {
+    assert(f);
+    strlist_filter_closure_ c = { f, data };
+    return strlist_map_strl(list, sep, out_sep, strlist_filter_map_, 0, &c);
+}
+
+strlist strlist_filter_mode(cstrlist list, sep_mode_t sep, const char * out_sep, strlist_filter_fn f, void * data) {
+    assert(f);
+    strlist_filter_closure_ c = { f, data };
+    return strlist_map_mode(list, sep, out_sep, strlist_filter_map_, 0, &c);
+}
+
 #endif
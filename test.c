@@ -43,6 +43,22 @@ Test(suite_strlist_len, str_lead) {
 
     cr_assert_eq(5, strlist_len_str(my_path, "/"));
 }
+
+Test(suite_strlist_len, mode_utf8) {
+    const char my_list[] = "a→b・c→d";
+
+    cr_assert_eq(4, strlist_len(my_list, strlist_sep_mode(STRLIST_UTF8, "→", "・")));
+    // "\xA9" is the tail of "é", it may not match on its own
+    cr_assert_eq(2, strlist_len_str("caf\xC3\xA9:x", "\xA9"));
+    cr_assert_eq(1, strlist_len("caf\xC3\xA9:x", strlist_sep_mode(STRLIST_UTF8, "\xA9")));
+}
+
+Test(suite_strlist_len, mode_icase) {
+    const char my_query[] = "cats AND dogs and birds And fish";
+
+    cr_assert_eq(4, strlist_len(my_query, strlist_sep_mode(STRLIST_ICASE, " and ")));
+    cr_assert_eq(2, strlist_len(my_query, strlist_sep_mode(STRLIST_EXACT, " and ")));
+}
 #undef suite_strlist_len
 
 /* =======================
@@ -110,6 +126,18 @@ Test(suite_strlist_short_hands, strarray) {
     cr_assert_str_eq(strlist_head(strdup(my_fields), sps), "a");
     cr_assert_str_eq(strlist_tail(strdup(my_fields), sps), "b.c->d.e");
 }
+
+Test(suite_strlist_short_hands, mode) {
+    // long enough to span several 16 byte blocks
+    const char my_query[] = "premierétage AND deuxième→étage and troisième AND dernier";
+
+    sep_mode_t sps = strlist_sep_mode(STRLIST_ICASE | STRLIST_UTF8, " and ", "→");
+
+    cr_assert_str_eq(strlist_root(strdup(my_query), sps), "premierétage AND deuxième→étage and troisième");
+    cr_assert_str_eq(strlist_base(strdup(my_query), sps), "dernier");
+    cr_assert_str_eq(strlist_head(strdup(my_query), sps), "premierétage");
+    cr_assert_str_eq(strlist_element(strdup(my_query), 2, sps), "étage");
+}
 #undef suite_strlist_shorthand
 
 /* =============================
@@ -141,4 +169,155 @@ Test(suite_strlist_loop, example) {
 
     cr_assert_eq(i, 5);
 }
+
+Test(suite_strlist_loop, mode) {
+    const char my_query[] = "x AND y and z";
+
+    const char * elements[] = { "x", "y", "z", };
+    int i = 0;
+
+    foreach_strlist (my_query, strlist_sep_mode(STRLIST_ICASE, " and "), e) {
+        cr_assert_str_eq(elements[i], e);
+        ++i;
+    }
+
+    cr_assert_eq(i, 3);
+}
+
+Test(suite_strlist_loop, strarray) {
+    const char my_fields[] = "a::b.c->d";
+
+    const char * elements[] = { "a", "b", "c", "d", };
+    int i = 0;
+
+    foreach_strlist (my_fields, ((sep_t)(const char * const []){"::", ".", "->", NULL}), e) {
+        cr_assert_str_eq(elements[i], e);
+        ++i;
+    }
+
+    cr_assert_eq(i, 4);
+}
 #undef suite_strlist_loop
+
+/* ==========================
+ * ==========================
+ * ===  __  __   _   ___  ===
+ * === |  \/  | /_\ | _ \ ===
+ * === | |\/| |/ _ \|  _/ ===
+ * === |_|  |_/_/ \_\_|   ===
+ * ==========================
+ * ==========================
+ */
+#define suite_strlist_map suite_strlist_map
+static size_t strlist_test_prefix(strlist_span e, char * out, void * data) {
+    const char * prefix = data;
+    const size_t prefix_len = strlen(prefix);
+
+    memcpy(out, prefix, prefix_len);
+    memcpy(out + prefix_len, e.data, e.len);
+    return prefix_len + e.len;
+}
+
+static size_t strlist_test_drop_empty(strlist_span e, char * out, [[ maybe_unused ]] void * data) {
+    if (e.len == 0) { return STRLIST_DROP; }
+
+    memcpy(out, e.data, e.len);
+    return e.len;
+}
+
+static size_t strlist_test_drop_all([[ maybe_unused ]] strlist_span e, [[ maybe_unused ]] char * out, [[ maybe_unused ]] void * data) {
+    return STRLIST_DROP;
+}
+
+static bool strlist_test_not_empty(strlist_span e, [[ maybe_unused ]] void * data) {
+    return e.len != 0;
+}
+
+Test(suite_strlist_map, char) {
+    const char my_path[] = "bin:usr/bin:opt/bin";
+
+    char * r = strlist_map(my_path, ':', ":", strlist_test_prefix, 1, "/");
+    cr_assert_str_eq(r, "/bin:/usr/bin:/opt/bin");
+    free(r);
+}
+
+Test(suite_strlist_map, char_lead) {
+    const char my_path[] = "/home/anon";
+
+    char * r = strlist_map(my_path, '/', "\\", strlist_test_prefix, 2, "x.");
+    cr_assert_str_eq(r, "\\x.home\\x.anon");
+    free(r);
+}
+
+Test(suite_strlist_map, str) {
+    const char my_dos_txt[] = "l1\\n\\r\\n\\rl3";
+
+    char * r = strlist_map(my_dos_txt, "\\n\\r", "\n", strlist_test_drop_empty, 0, NULL);
+    cr_assert_str_eq(r, "l1\nl3");
+    free(r);
+}
+
+Test(suite_strlist_map, strarray) {
+    const char my_fields[] = "a::b.c->d.e";
+
+    char * r = strlist_map(my_fields, ((sep_t)(const char * const []){"::", ".", "->", NULL}), ".", strlist_test_prefix, 1, "_");
+    cr_assert_str_eq(r, "_a._b._c._d._e");
+    free(r);
+}
+
+Test(suite_strlist_map, empty) {
+    char * r = strlist_map("", ':', ":", strlist_test_prefix, 1, "/");
+    cr_assert_str_eq(r, "");
+    free(r);
+}
+
+Test(suite_strlist_map, all_dropped) {
+    // the leading separator alone would be a 1 element list
+    char * r = strlist_map(":a", ':', ";", strlist_test_drop_all, 0, NULL);
+    cr_assert_str_eq(r, "");
+    free(r);
+
+    r = strlist_filter("::", ':', ";", strlist_test_not_empty, NULL);
+    cr_assert_str_eq(r, "");
+    free(r);
+}
+
+Test(suite_strlist_map, growth_overflow) {
+    cr_assert_eq(NULL, strlist_map("a:b", ':', ":", strlist_test_prefix, SIZE_MAX / 3, "/"));
+    cr_assert_eq(NULL, strlist_map("a:b", ':', ":", strlist_test_prefix, SIZE_MAX, "/"));
+}
+
+Test(suite_strlist_map, mode) {
+    const char my_query[] = "Cats AND dogs→birds and fish";
+
+    char * r = strlist_map(my_query, strlist_sep_mode(STRLIST_ICASE | STRLIST_UTF8, " and ", "→"), ",", strlist_test_prefix, 1, "#");
+    cr_assert_str_eq(r, "#Cats,#dogs,#birds,#fish");
+    free(r);
+}
+#undef suite_strlist_map
+
+#define suite_strlist_filter suite_strlist_filter
+Test(suite_strlist_filter, char) {
+    const char my_path[] = ":/bin::/usr/bin:";
+
+    char * r = strlist_filter(my_path, ':', ";", strlist_test_not_empty, NULL);
+    cr_assert_str_eq(r, ";/bin;/usr/bin");
+    free(r);
+}
+
+Test(suite_strlist_filter, strarray) {
+    const char my_fields[] = "a::.b->->c";
+
+    char * r = strlist_filter(my_fields, ((sep_t)(const char * const []){"::", ".", "->", NULL}), "/", strlist_test_not_empty, NULL);
+    cr_assert_str_eq(r, "a/b/c");
+    free(r);
+}
+
+Test(suite_strlist_filter, mode) {
+    const char my_query[] = " AND cats and  AND dogs";
+
+    char * r = strlist_filter(my_query, strlist_sep_mode(STRLIST_ICASE, " and "), " and ", strlist_test_not_empty, NULL);
+    cr_assert_str_eq(r, " and cats and dogs");
+    free(r);
+}
+#undef suite_strlist_filter